@@ -6,25 +6,33 @@
 //#define DEBUGBUF
 
 // declarations for buffer pool hash table
-struct hashBucket
+struct hashEntry
 {
-	File*	file;    // pointer a file object (more on this below)
+	const File*	file;    // pointer a file object, NULL if entry is free
 	int	pageNo;  // page number within a file
 	int	frameNo; // frame number of page in the buffer pool
-	hashBucket* 	next;	 // next node in the hash table
 };
 
 
-// hash table to keep track of pages in the buffer pool
+// hash table to keep track of pages in the buffer pool.  The entries
+// live in one array of at least twice the number of frames, so the
+// table never fills up and never allocates after construction; a
+// collision moves on to the next entry of the array.
 class BufHashTbl
 {
 private:
-    int HTSIZE;
-    hashBucket**  ht; // actual hash table
+    int HTSIZE;   // number of entries, a power of two
+    int maxEntries; // max. number of entries in use
+    int numEntries; // number of entries in use
+    hashEntry*  ht; // actual hash table
     int	 hash(const File* file, const int pageNo); // returns value between 0 and HTSIZE-1
 
+    // index of the entry of (file,pageNo), or of the free entry where
+    // the search for it ended
+    int	 find(const File* file, const int pageNo);
+
 public:
-    BufHashTbl(const int htSize);  // constructor
+    BufHashTbl(const int maxEntries);  // constructor
     ~BufHashTbl(); // destructor
 	
     // insert entry into hash table mapping (file,pageNo) to frameNo;
@@ -0,0 +1,54 @@
+#include "query.h"
+
+
+// In-memory table of hash aggregation.  Each group takes one entry of
+// an open-addressing table, holding the number of tuples in the group,
+// the hash and values of its group attributes and the running state of
+// each aggregate.  The table is sized for a memory budget and refuses
+// new groups once it is three quarters full.
+
+class aggHashTbl
+{
+private:
+    int		groupCnt;	// number of group attributes
+    const AttrDesc* groupAttrs;	// group attributes
+    int		outCnt;		// number of attributes of a result tuple
+    const AggFunc* aggs;	// aggregate computed by each of them
+    const AttrDesc* outAttrs;	// attribute each one is computed from
+    unsigned	salt;		// varies the hash function
+    int*	keyOffsets;	// offset of each group attribute in a key
+    int*	stateOffsets;	// offset of each aggregate in an entry
+    int		keyLen;		// bytes of the group attribute values
+    int		entryLen;	// bytes of an entry
+    int		HTSIZE;		// number of entries
+    int		maxGroups;	// groups allowed in the table
+    int		groups;		// groups in the table
+    char*	ht;		// actual hash table
+    char*	key;		// key of the tuple being added
+
+    // copy the group attribute values of rec into key
+    void makeKey(const char* rec, char* dst) const;
+
+public:
+    aggHashTbl(const int groupCnt, const AttrDesc groupAttrs[],
+	       const int outCnt, const AggFunc aggs[],
+	       const AttrDesc outAttrs[], const int budget,
+	       const unsigned salt);
+    ~aggHashTbl();
+
+    // hash of the group attribute values of rec, with the given salt
+    static unsigned hash(const char* rec, const int groupCnt,
+			 const AttrDesc groupAttrs[], const unsigned salt);
+
+    // fold the tuple rec into its group.  Returns NOSPACE, leaving the
+    // table unchanged, if rec starts a new group and the table is full
+    Status add(const char* rec);
+
+    // insert one result tuple per group into result, laid out at
+    // outOffsets, and empty the table
+    Status emit(InsertFileScan & result, const int outOffsets[],
+		const int reclen, int & tupCnt);
+
+    const int getGroupCnt() const { return groups; }
+    const int getMaxGroups() const { return maxGroups; }
+};
@@ -0,0 +1,42 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include "heapfile.h"
+
+// define if debug output wanted
+//#define DEBUGBLOOM
+
+
+// A BloomFilter summarizes the join attribute values seen on the build
+// side of a hash join.  It answers "definitely not present" or "maybe
+// present" for a probe value, so that a scan of the probe relation can
+// drop tuples which cannot possibly join before they are hashed, probed
+// or written to a partition file.  Values are compared with the same
+// semantics as the join itself: INTEGER and FLOAT by value, STRING up
+// to the first null byte or attrLen bytes, whichever comes first.
+
+class BloomFilter {
+ public:
+  BloomFilter(const int expectedKeys,     // number of keys to be added
+	      const Datatype type,        // type of the join attribute
+	      const int length);          // length of the join attribute
+  ~BloomFilter();
+
+  void add(const char* attrPtr);             // add a join attribute value
+  bool mayContain(const char* attrPtr) const; // false => value never added
+  void clear();                              // forget all values
+
+  // hash of an attribute value, well mixed in all 32 bits
+  static unsigned int hash(const char* attrPtr,
+			   const Datatype type,
+			   const int length);
+
+ private:
+
+  Datatype type;                        // type of the filtered attribute
+  int length;                           // length of the filtered attribute
+  unsigned int numBits;                 // size of bit array (power of 2)
+  unsigned int* bits;                   // the bit array itself
+};
+
+#endif
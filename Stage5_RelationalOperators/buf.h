@@ -1,30 +1,43 @@
 #ifndef BUF_H
 #define BUF_H
 
+#include <vector>
 #include "db.h"
+#include "buftrace.h"
 // define if debug output wanted
 //#define DEBUGBUF
 
+#define WARMNAME      "minirel.warm"    // pages in the pool at the last save
+#define PREFETCHPAGES 32                // warm pages read per statement
+
 // declarations for buffer pool hash table
-struct hashBucket
+struct hashEntry
 {
-	File*	file;    // pointer a file object (more on this below)
+	const File*	file;    // pointer a file object, NULL if entry is free
 	int	pageNo;  // page number within a file
 	int	frameNo; // frame number of page in the buffer pool
-	hashBucket* 	next;	 // next node in the hash table
 };
 
 
-// hash table to keep track of pages in the buffer pool
+// hash table to keep track of pages in the buffer pool.  The entries
+// live in one array of at least twice the number of frames, so the
+// table never fills up and never allocates after construction; a
+// collision moves on to the next entry of the array.
 class BufHashTbl
 {
 private:
-    int HTSIZE;
-    hashBucket**  ht; // actual hash table
+    int HTSIZE;   // number of entries, a power of two
+    int maxEntries; // max. number of entries in use
+    int numEntries; // number of entries in use
+    hashEntry*  ht; // actual hash table
     int	 hash(const File* file, const int pageNo); // returns value between 0 and HTSIZE-1
 
+    // index of the entry of (file,pageNo), or of the free entry where
+    // the search for it ended
+    int	 find(const File* file, const int pageNo);
+
 public:
-    BufHashTbl(const int htSize);  // constructor
+    BufHashTbl(const int maxEntries);  // constructor
     ~BufHashTbl(); // destructor
 	
     // insert entry into hash table mapping (file,pageNo) to frameNo;
@@ -55,6 +68,11 @@ private:
   bool 	dirty;	  // true if dirty;  false otherwise
   bool 	valid;   // true if page is valid
   bool  refbit;	 // has this buffer frame been reference recently
+  bool  changed;  // true if updated since its after-image was logged
+  int   lsn;      // log sequence number of its last after-image
+  int   refCnt;   // times pinned since it was read, its hotness
+  int   prevFrame; // frames holding pages of the same file, -1 if none
+  int   nextFrame;
 
   void Clear() {  // initialize buffer frame for a new user
     	pinCnt = 0;
@@ -62,6 +80,9 @@ private:
 	pageNo = -1;
     	dirty = false;
 	valid = false;
+	changed = false;
+	lsn = 0;
+	refCnt = 0;
   };
 
   void Set(File* filePtr, int pageNum) { 
@@ -71,6 +92,9 @@ private:
       dirty = false;
       valid = true;
       refbit = true;
+      changed = false;
+      lsn = 0;
+      refCnt = 1;
   }
 
   BufDesc() {
@@ -84,10 +108,12 @@ struct BufStats
   int accesses;    // Total number of accesses to buffer pool
   int diskreads;   // Number of pages read from disk (including allocs)
   int diskwrites;  // Number of pages written back to disk
+  int hits;        // Number of readPage calls that found the page
+  int misses;      // Number of readPage calls that had to read it
 
   void clear()
     {
-      accesses = diskreads = diskwrites = 0;
+      accesses = diskreads = diskwrites = hits = misses = 0;
     }
       
   BufStats()
@@ -97,6 +123,16 @@ struct BufStats
 };
 
 
+// a page of the warm set, the pages that were in the buffer pool when
+// it was last saved
+struct WarmPage
+{
+  string fileName; // file of the page
+  int    pageNo;   // page within file
+  int    refCnt;   // its hotness when saved
+};
+
+
 class BufMgr 
 {
 private:
@@ -105,9 +141,25 @@ private:
   BufHashTbl*    hashTable;  	// hash table mapping (File, page) to frame
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
+  vector<WarmPage> warmPages;	// warm set loaded at startup
+  BufTrace*	 trace;		// trace of accesses, NULL if not tracing
+  unsigned int	 nextWarm;	// next page of it to prefetch
+  vector<int>	 changedFrames;	// frames changed since logPages(), a
+				// frame may be listed twice or no longer
+				// be changed
 
   const Status allocBuf(int & frame);   // allocate a free frame.  
   const void releaseBuf(int frame); // return unused frame to end of list
+  const Status writeFrame(const int frame); // write page in frame to disk
+  const Status evictFrame(const int frame); // empty an unpinned frame
+
+  // add a frame that was just set up to the frames of its file, or
+  // take it off before it is cleared
+  void linkFrame(const int frame);
+  void unlinkFrame(const int frame);
+
+  // frames holding pages of file, in order of pageNo
+  void fileFrames(const File* file, vector<int> & frames);
   void advanceClock()
   {
 	clockHand = (clockHand + 1) % numBufs;
@@ -115,7 +167,7 @@ private:
 
 
 public:
-  Page*	         bufPool;   // actual buffer pool
+  Page**	         bufPool;   // actual buffer pool, one page per frame
 
   BufMgr(const int bufs);
   ~BufMgr();
@@ -125,9 +177,32 @@ public:
   const Status allocPage(File* file, int& PageNo, Page*& page); 
                         // allocates a new, empty page 
   const Status flushFile(const File* file); // writing out all dirty pages of the file
+  const Status flushAll(); // write out all dirty pages, keeping them cached
+  const Status discardFile(const File* file); // drop pages of file unwritten
+  const Status logPages(); // log after-images of pages changed since last call
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
+  const Status resize(const int bufs); // change the number of frames
+
+  // save the pages in the pool as the warm set, and load the warm set
+  // saved last for prefetch()
+  const Status saveWarmSet();
+  const Status loadWarmSet();
+
+  // read up to maxPages pages of the warm set into free frames
+  void  prefetch(const int maxPages);
+
+  // start a new trace of the accesses, keeping the last capacity
+  // ones; 0 stops tracing
+  const Status setTrace(const int capacity);
   void  printSelf();
 
+  int   getNumBufs() const // number of frames in the buffer pool
+  {
+	return numBufs;
+  }
+
+  int   getNumUnpinned() const; // number of frames not pinned
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
@@ -138,5 +213,9 @@ public:
   }
 };
 
-#endif
 
+// number of frames of a buffer pool of size pages, or of size bytes if
+// it ends in K, M or G; 0 if malformed
+const int poolPages(const char* size);
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef BUFTRACE_H
+#define BUFTRACE_H
+
+#include <string>
+#include "error.h"
+using namespace std;
+
+
+#define TRACENAME     "minirel.trace"   // name of the trace in the database
+#define TRACEMAGIC    0x42554654        // first word of a trace file
+#define TRACEBUFRECS  256               // records buffered in memory
+
+
+// kinds of buffer pool accesses
+
+enum TraceEvent { TRACEHIT, TRACEMISS, TRACEALLOC, TRACEUNPIN };
+
+
+// A trace file starts with a TraceHdr, followed by room for capacity
+// TraceRecs used as a ring: record number i is kept in slot
+// i % capacity, so the file holds the last capacity of the next
+// records written.
+
+struct TraceHdr
+{
+  int magic;                            // TRACEMAGIC
+  int capacity;                         // number of record slots
+  long long next;                       // number of records written
+};
+
+struct TraceRec
+{
+  long long time;                       // microseconds since the epoch
+  unsigned int file;                    // hash of the file name
+  int pageNo;                           // page within file
+  int event;                            // TraceEvent
+  int pad;
+};
+
+
+// The BufTrace records the accesses of the buffer manager to TRACENAME
+// while tracing is on.  Records are collected in memory and written in
+// groups of TRACEBUFRECS.  bufsim replays a trace against replacement
+// policies.
+
+class BufTrace {
+ public:
+  BufTrace(const int capacity, Status & status); // start a new trace
+  ~BufTrace();                          // write out buffered records
+
+  // record an access to page pageNo of file fileName
+  void record(const string & fileName, const int pageNo,
+	      const TraceEvent event);
+
+  // hash of a file name as recorded in TraceRec::file
+  static unsigned int fileHash(const string & fileName);
+
+ private:
+  const Status flush();
+
+  int traceFile;                        // unix file of the trace
+  TraceHdr hdr;                         // header as last written
+  TraceRec buf[TRACEBUFRECS];           // records not yet written
+  int bufUsed;                          // records used in buf
+};
+
+#endif
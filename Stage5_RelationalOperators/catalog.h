@@ -10,6 +10,7 @@
 
 #define RELCATNAME   "relcat"           // name of relation catalog
 #define ATTRCATNAME  "attrcat"          // name of attribute catalog
+#define STATCATNAME  "statcat"          // name of statistics catalog
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
 
@@ -48,10 +49,11 @@ class RelCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation);
 
-  // create a new relation
+  // create a new relation, stored in the given layout
   const Status createRel(const string & relation, 
 		   const int attrCnt, 
-		   const attrInfo attrList[]);
+		   const attrInfo attrList[],
+		   const Layout layout = ROWLAYOUT);
 
   // destroy a relation
   const Status destroyRel(const string & relation);
@@ -70,6 +72,7 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   attribute position : integer(4)
 
 
 typedef struct {
@@ -78,9 +81,21 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int attrNo;                           // position in declaration order
 } AttrDesc;
 
 
+// Lays out a tuple with the given attributes: integers and floats
+// first, at offsets aligned for direct access, then the strings, each
+// group in the given order.  Stores the offset of each attribute in
+// offsets[], unless it is NULL, and returns the length of the tuple,
+// rounded up to RECALIGN.
+
+extern const int layoutAttrs(const int attrCnt,
+			     const AttrDesc attrs[],
+			     int offsets[]);
+
+
 class AttrCatalog : public HeapFile {
  friend class RelCatalog;
 
@@ -99,7 +114,7 @@ class AttrCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation, const string & attrName);
 
-  // get all attributes of a relation
+  // get all attributes of a relation, in declaration order
   const Status getRelInfo(const string & relation, 
 			  int &attrCnt, 
 			  AttrDesc *&attrs);
@@ -112,10 +127,82 @@ class AttrCatalog : public HeapFile {
 };
 
 
+// schema of statistics catalog:
+//   relation name : char(32)           <-- lookup keys
+//   attribute name : char(32)          <--
+//   tuple count : integer(4)
+//   page count : integer(4)
+//   distinct values : integer(4)
+//   MCV count : integer(4)
+//   min, max : char(16) each
+//   histogram bounds : char(16) x (STATBUCKETS + 1)
+//   MCV values : char(16) x STATMCVS
+//   MCV frequencies : integer(4) x STATMCVS
+//
+// Values are stored in their binary form; strings are truncated to
+// STATVALLEN bytes.
+
+
+#define STATBUCKETS  10                 // buckets in equi-depth histogram
+#define STATMCVS     5                  // most common values kept
+#define STATVALLEN   16                 // bytes kept of each value
+#define STATSTALEPCT 20                 // % change in tuples before re-analyze
+#define STATSAMPLEPAGES 300             // pages sampled of larger relations
+
+
+typedef struct {
+  char relName[MAXNAME];                // relation name
+  char attrName[MAXNAME];               // attribute name
+  int recCnt;                           // tuples in relation when analyzed
+  int pageCnt;                          // pages in relation when analyzed
+  int distinct;                         // estimated number of distinct values
+  int mcvCnt;                           // number of most common values
+  char minVal[STATVALLEN];              // smallest value
+  char maxVal[STATVALLEN];              // largest value
+  char bounds[STATBUCKETS + 1][STATVALLEN]; // histogram bucket boundaries
+  char mcvVal[STATMCVS][STATVALLEN];    // most common values
+  int mcvFreq[STATMCVS];                // and how often each occurs
+} StatDesc;
+
+
+class StatCatalog : public HeapFile {
+ public:
+  // open statistics catalog
+  StatCatalog(Status &status);
+
+  // get statistics for an attribute
+  const Status getInfo(const string & relation, 
+		       const string & attrName, 
+		       StatDesc &record);
+
+  // add information to catalog
+  const Status addInfo(StatDesc & record);
+
+  // get statistics for all attributes of a relation
+  const Status getRelInfo(const string & relation, 
+			  int &attrCnt, 
+			  StatDesc *&stats);
+
+  // delete all statistics about a relation
+  const Status dropRelation(const string & relation);
+
+  // compute and store statistics for a relation
+  const Status analyze(const string & relation);
+
+  // re-analyze a relation if its statistics have gone stale
+  const Status refresh(const string & relation);
+
+  // print statistics of a relation
+  const Status help(const string & relation);
+
+  // close statistics catalog
+  ~StatCatalog();
+};
+
+
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
+extern StatCatalog *statCat;
 extern Error error;
-extern Status createHeapFile(const string filename);
-extern Status destroyHeapFile(const string filename);
 
 #endif
@@ -19,6 +19,8 @@ class DB;
 class File {
   friend class DB;
   friend class OpenFileHashTbl;
+  friend class BufMgr;
+  friend class LogMgr;
 
  public:
 
@@ -58,6 +60,8 @@ class File {
   string fileName;                    // The name of the file
   int openCnt;                        // # times file has been opened
   int unixFile;                       // unix file stream for file
+  int firstFrame;                     // first buffer frame holding a page
+                                      // of the file, -1 if none
 };
 
 class BufMgr;
@@ -11,9 +11,11 @@
 using namespace std;
 
 #include "page.h"
+#include "paxpage.h"
 #include "buf.h"
 
 extern DB db;
+class BloomFilter;
 
 // define if debug output wanted
 //#define DEBUGREL
@@ -23,6 +25,66 @@ const unsigned MAXNAMESIZE = 50;
 
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
+enum Layout { ROWLAYOUT, PAXLAYOUT, CPAXLAYOUT }; // layouts of data pages
+enum SampleMethod { PAGESAMPLE, ROWSAMPLE };  // sampling scans
+
+// The zone map of a heap file keeps, for each data page, the minimum
+// and maximum value of up to ZONEATTRS attributes over the records
+// inserted into the page.  A filtered scan uses it to skip pages that
+// cannot hold a matching record.  Strings are summarized by their
+// first ZONEVALLEN bytes.  Deleting records does not shrink the
+// ranges, so they may be wider than the records actually on the page.
+
+const int ZONEATTRS = 8;		// max. attributes in a zone map
+const int ZONEVALLEN = 4;		// bytes kept of a min/max value
+
+struct ZoneAttr
+{
+  int		offset;		// byte offset of attribute in record
+  int		length;		// length of attribute
+  int		type;		// Datatype of attribute
+};
+
+struct ZoneEntry
+{
+  int		pageNo;		// data page summarized by the entry
+  int		recCnt;		// records inserted into it, 0 if none
+  char		minVal[ZONEATTRS][ZONEVALLEN];
+  char		maxVal[ZONEATTRS][ZONEVALLEN];
+};
+
+const int ZONESPERPAGE = (PAGESIZE - sizeof(int)) / sizeof(ZoneEntry);
+
+// side page holding the zone map entries of consecutive data pages
+struct ZonePage
+{
+  int		nextPage;	// pageNo of next zone map page, -1 if none
+  ZoneEntry	entry[ZONESPERPAGE];
+};
+
+// The records of a heap file may store their strings variable-length:
+// a record then holds its first fixedLen bytes (the integers and floats
+// placed first by layoutAttrs) as they are, one length byte for each of
+// the varAttrCnt strings, and the bytes of each string up to its first
+// null.  Records are expanded to their full recLen bytes when read.
+// Files in PAX layout keep their records on PaxPages instead, or in
+// compressed PAX layout on CPaxPages, which need the length of every
+// attribute; their strings are stored in full.
+
+const int VARATTRS = 32;		// max. strings stored variable-length
+const int PAXATTRS = 64;		// max. attributes of a PAX relation
+
+struct RecFormat
+{
+  int		recLen;		// length of an expanded record
+  int		fixedLen;	// bytes of the record before its strings
+  int		varAttrCnt;	// number of strings, 0 if stored in full
+  unsigned char	varLens[VARATTRS]; // declared length of each string
+  int		layout;		// Layout of the data pages
+  int		attrCnt;	// PAX: number of attributes
+  short		attrLens[PAXATTRS]; // PAX: lengths, in record order
+  char		attrTypes[PAXATTRS]; // PAX: Datatypes, in record order
+};
 
 struct FileHdrPage
 {
@@ -31,9 +93,25 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		zoneAttrCnt;	// number of attributes in zone map, 0 if none
+  ZoneAttr	zoneAttrs[ZONEATTRS]; // attributes in zone map
+  int		firstZonePage;	// pageNo of first zone map page
+  int		lastZonePage;	// pageNo of last zone map page
+  int		zoneCnt;	// number of zone map entries
+  RecFormat	format;		// record format
 };
 
 
+// create and destroy the file underlying a heap file.  createHeapFile
+// keeps a zone map of the attributes in zoneAttrs, if any, and stores
+// records in the given format, if any.
+const Status createHeapFile(const string fileName,
+			    const int zoneAttrCnt = 0,
+			    const ZoneAttr zoneAttrs[] = NULL,
+			    const RecFormat* format = NULL);
+const Status destroyHeapFile(const string fileName);
+
+
 // class definition of heapFile
 class HeapFile {
 protected:
@@ -46,6 +124,26 @@ protected:
    int   	curPageNo;	// page number of pinned page
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
+   char*	expandBuf;	// expanded copy of a variable-length record
+   bool		pax;		// true if data pages are PaxPages
+   bool		cpax;		// true if data pages are CPaxPages
+   PaxImage*	image;		// decoded copy of a CPaxPage
+
+   // point rec at an expanded copy of the record, if the file stores
+   // strings variable-length
+   void expand(Record & rec);
+
+   // record operations on curPage, for either layout.  readRecord
+   // returns the record expanded.
+   const Status firstRecord(RID & rid) const;
+   const Status nextRecord(const RID & curRid, RID & nextRid) const;
+   const Status readRecord(const RID & rid, Record & rec);
+
+   // decoded contents of curPage, if it is a CPaxPage
+   PaxImage* getImage();
+
+   // index of the PAX attribute at offset, and its length; -1 if none
+   const int attrAt(const int offset, int & length) const;
 
 public:
 
@@ -58,6 +156,9 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCnt() const;
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
 };
@@ -94,12 +195,48 @@ public:
     // marks current page of scan dirty
     const Status markDirty();
 
+    // drop records whose attribute at offset is not in the filter.
+    // applied in addition to the predicate of startScan(); pass NULL
+    // to remove the filter
+    const Status setBloomFilter(const BloomFilter* bloom, 
+                                const int offset);
+
+    // true if a scan that starts while other scans of the file are in
+    // progress joins them at the page they most recently read, wrapping
+    // around to the pages before it at the end of the file.  Its records
+    // then come back in that rotated order.
+    static bool synchronize;
+
+    // return only a random sample of about percent of the records: all
+    // those on percent of the data pages, which are the only pages read
+    // (PAGESAMPLE), or percent of the records of every page (ROWSAMPLE).
+    // Every scan of an unchanged file returns the same sample.  Takes
+    // effect when the scan starts.
+    const Status setSample(const double percent,
+                           const SampleMethod method);
+
+    // sample every scan of the relation created from now on, until
+    // another relation, or with an empty name none, is given
+    static void sampleRelation(const string & name,
+                               const double percent,
+                               const SampleMethod method);
+
 private:
     int   offset;            // byte offset of filter attribute
     int   length;            // length of filter attribute
     Datatype type;           // datatype of filter attribute
     const char* filter;      // comparison value of filter
     Operator op;             // comparison operator of filter
+    const BloomFilter* bloom; // join key filter pushed down by a hash join
+    int   bloomOffset;       // byte offset of the attribute bloom filters
+    int   bloomLength;       // its length
+    int   filterAttr;        // PAX attribute of the filter
+    int   bloomAttr;         // PAX attribute of the bloom filter
+
+    // slots of the CPaxPage matchPageNo that satisfy the filter and the
+    // bloom filter, found one attribute at a time
+    int   matchPageNo;
+    unsigned char matches[CPAXSLOTS / 8];
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -107,8 +244,50 @@ private:
     // scan to be rolled back to the following
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
-
-    const bool matchRec(const Record & rec) const;
+    int   markedZone;        // zone map entry of marked page
+    int   markedZonePageNo;  // zone map page holding it
+
+    int   zoneAttr;          // zone map attribute of the filter, -1 if none
+    int   curZone;           // zone map entry of current page, -1 if unknown
+    int   curZonePageNo;     // zone map page holding it
+
+    // state of a synchronized scan
+    bool  started;           // scanNext() called since construction or endScan()
+    bool  joined;            // counted in the scans in progress of the file
+    int   startPageNo;       // page the scan joined at, -1 if the first page
+    int   startZone;         // its zone map entry, -1 if unknown
+    bool  wrapped;           // past the end of the file, back at the front
+    bool  markedWrapped;     // wrapped at markScan()
+
+    // join or leave the scans in progress of the file, and tell them
+    // about the page read last
+    void joinScans();
+    void leaveScans();
+    void reportPage();
+
+    // state of a sampling scan
+    double samplePct;        // percent of pages or records, -1 if all
+    SampleMethod sampleMethod;
+    vector<int> samplePages; // PAGESAMPLE: data pages to read, in order
+    int   samplePos;         // index of the current page in samplePages
+    unsigned long long sampleRand;  // state of the random numbers
+    int   markedSamplePos;   // samplePos at markScan()
+    unsigned long long markedSampleRand;
+
+    // pick the data pages of a PAGESAMPLE scan
+    const Status choosePages();
+
+    // true if the next record is in the sample
+    const bool sampleRec();
+
+    // test the record with RID rid on curPage
+    const bool matchRec(const RID & rid);
+    const bool matchVal(const char* val, const char* bloomVal) const;
+    const bool matchFilter(const char* val) const;
+    void matchAttr(const int attr, const bool useBloom);
+
+    // page number of the next data page that may hold a match
+    const Status nextDataPage(int & nextPageNo);
 };
 
 
@@ -123,6 +302,16 @@ public:
 
     // insert record into file, returning its RID
     const Status insertRecord(const Record & rec, RID& outRid); 
+
+    // hand updated pages to the buffer manager, keeping them pinned
+    const Status sync();
+
+private:
+    // insert rec into curPage, a CPaxPage
+    const Status insertPacked(const Record & rec, RID & rid);
+
+    // widen the zone map entry of the last page to cover rec
+    const Status updateZone(const Record & rec);
 };
 
 #endif
@@ -1,3 +1,5 @@
+#include "bloom.h"
+
 
 class joinHashTbl
 {
@@ -25,6 +27,7 @@ private:
     AttrDesc 	joinAttr;
     int 	HTSIZE;
     HTentry 	*ht; // actual hash table
+    BloomFilter *bloom; // summary of all join attribute values inserted
     int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
 
 public:
@@ -36,5 +39,53 @@ public:
 
      // get RIDs of records whose join attribute value matches innerJoinAttrValue
      Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+
+     // bloom filter over the inserted join attribute values, suitable for
+     // pushing into the scan of the probe relation
+     const BloomFilter* getBloomFilter() const { return bloom; }
 };
 
+
+
+// Table of the distinct tuples of the set operations.  Tuples are kept
+// whole, as projected into the result, and are compared byte for byte,
+// so the bytes of a string attribute after its null must be cleared.
+// Each entry records which of the two inputs its tuple was seen in.
+// The table is open-addressing, sized for a memory budget, and refuses
+// new tuples once it is three quarters full.
+
+class setHashTbl
+{
+private:
+    int		tupleLen;	// bytes of a tuple
+    int		entryLen;	// bytes of an entry
+    int		HTSIZE;		// number of entries
+    int		maxTuples;	// tuples allowed in the table
+    int		tuples;		// tuples in the table
+    unsigned	salt;		// varies the hash function
+    char*	ht;		// actual hash table
+
+    // entry holding tuple, or the free entry where it belongs
+    char* find(const char* tuple, const unsigned h) const;
+
+public:
+    setHashTbl(const int tupleLen, const int budget, const unsigned salt);
+    ~setHashTbl();
+
+    static unsigned hash(const char* tuple, const int tupleLen,
+			 const unsigned salt);
+
+    // add tuple, seen in input side (0 or 1).  Returns NOSPACE, leaving
+    // the table unchanged, if the tuple is new and the table is full
+    Status insert(const char* tuple, const int side);
+
+    // note that tuple was seen in input side, if it is in the table
+    void mark(const char* tuple, const int side);
+
+    // insert the tuples that belong to the result of setOp into result,
+    // and empty the table
+    Status emit(InsertFileScan & result, const SetOp setOp, int & tupCnt);
+
+    const int getTupleCnt() const { return tuples; }
+    const int getMaxTuples() const { return maxTuples; }
+};
@@ -0,0 +1,90 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <set>
+#include <vector>
+#include "buf.h"
+
+// define if debug output wanted
+//#define DEBUGLOG
+
+
+#define LOGNAME       "minirel.log"     // name of the log in the database
+#define LOGNAMELEN    50                // length of file names in the log
+#define LOGBUFSIZE    (32 * 1024)       // bytes of log buffered in memory
+#define LOGCHECKPOINT (1024 * 1024)     // log size that starts a checkpoint
+
+
+// kinds of log records
+
+enum LogRecType { LOGPAGE, LOGDESTROY, LOGCOMMIT };
+
+
+// header of every log record.  A LOGPAGE record is followed by the
+// after-image of the page.
+
+struct LogRecHdr
+{
+  int type;                             // LogRecType
+  int lsn;                              // log sequence number
+  int pageNo;                           // page of a LOGPAGE record
+  unsigned int checksum;                // of header and page image
+  char fileName[LOGNAMELEN];            // file of LOGPAGE, LOGDESTROY
+};
+
+
+// The LogMgr keeps a redo-only write-ahead log of page after-images.
+// Every statement is a transaction: when it is done, commit() logs the
+// pages it changed followed by a commit record and forces the log, so
+// a statement is durable before the next one is read.  All the pages
+// a statement changed share that one force.  Data pages are
+// written lazily by the buffer manager and by checkpoints, which also
+// empty the log.  Statements are not undone, so pages that a statement
+// wrote out before it finished stay changed if it never commits.
+
+class LogMgr {
+ public:
+  LogMgr(Status & status);              // open log, recover database
+  ~LogMgr();                            // checkpoint and close log
+
+  // end of a statement: log the pages it changed and commit it
+  const Status commit();
+
+  // append the after-image of a page; returns its lsn
+  const Status logPage(File* file, const int pageNo,
+		       const Page* page, int & lsn);
+
+  // a file is being destroyed; forget its pages
+  const Status logDestroy(File* file);
+
+  // called before the buffer manager writes a page whose last
+  // after-image has sequence number lsn.  If the page was changed
+  // after that, the file is synced when the log is next forced.
+  const Status beforeWrite(File* file, const int lsn, const bool changed);
+
+  // make the log durable up to and including lsn
+  const Status force(const int lsn);
+
+  // write all dirty pages to disk and empty the log
+  const Status checkpoint();
+
+ private:
+  const Status recover();
+  const Status append(LogRecHdr & hdr, const Page* page);
+  const Status writeBuf();
+  const Status syncFiles();
+
+  int logFile;                          // unix file of the log
+  char* buf;                            // log records not yet written
+  int bufUsed;                          // bytes used in buf
+  long logSize;                         // bytes in the log, incl. buf
+  int nextLsn;                          // lsn of next log record
+  int commitLsn;                        // lsn of last commit record
+  int flushedLsn;                       // last lsn on disk
+  set<string> loggedFiles;              // files with pages in the log
+  vector<File*> unsynced;               // files to sync on next force
+};
+
+extern LogMgr* logMgr;
+
+#endif
@@ -18,21 +18,26 @@ struct Record
 
 // slot structure
 struct slot_t {
-        short	offset;  
+        short	offset;  // if not in use, number of next free slot or -1
         short	length;  // equals -1 if slot is not in use
 };
 
 const unsigned PAGESIZE = 1024;
-const unsigned DPFIXED= sizeof(slot_t)+4*sizeof(short)+2*sizeof(int);
+const unsigned DPFIXED= sizeof(slot_t)+6*sizeof(short)+2*sizeof(int);
 const unsigned PAGEDATASIZE = PAGESIZE-DPFIXED+sizeof(slot_t);
 // size of the data area of a page
+const unsigned RECALIGN = sizeof(int);
+// alignment of records in the data area
 
 // Class definition for a minirel data page.   
-// The design assumes that records are kept compacted when
-// deletions are performed. Notice, however, that the slot
-// array cannot be compacted.  Notice, this class does not keep
-// the records align, relying instead on upper levels to take
-// care of non-aligned attributes
+// Deleting a record only frees its slot and leaves a hole in the
+// data area; the records are compacted when an insertion needs
+// the space held by the holes.  Notice, however, that the slot
+// array cannot be compacted.  Its unused slots are chained
+// together so that an insertion finds one without a search.
+// Records start at offsets that are multiples of RECALIGN, so
+// that attributes laid out by RelCatalog::createRel can be
+// accessed in place.
 
 class Page {
 private:
@@ -41,10 +46,14 @@ private:
     short	slotCnt; // number of slots in use;
     short	freePtr; // offset of first free byte in data[]
     short	freeSpace; // number of bytes free in data[]
+    short	holeSpace; // bytes of deleted records left in data[]
+    short	freeSlot; // number of first unused slot, -1 if none
     short	dummy;	// for alignment purposes
     int		nextPage; // forwards pointer
     int		curPage;  // page number of current pointer
 
+    void compact(); // squeeze the holes out of data[]
+
 public:
     void init(const int pageNo); // initialize a new page
     void dumpPage() const;       // dump contents of a page
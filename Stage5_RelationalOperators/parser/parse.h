@@ -65,7 +65,12 @@ typedef enum {
     N_ATTRTYPE,
     N_VALUE,
     N_LIST,
-    N_ALIAS
+    N_ALIAS,
+    N_ANALYZE,
+    N_SET,
+    N_ORDER,
+    N_EXPLAIN,
+    N_SAMPLE
 } NODEKIND;
 
 
@@ -82,12 +87,19 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *grouplist;	// group by attributes, or NULL
+	    int distinct;		// duplicates are removed
+	    int setop;			// combines the query with setquery
+	    struct node *setquery;	// second query of a set operation
+	    struct node *order;		// order by, or NULL
+	    struct node *sample;	// tablesample, or NULL
 	} QUERY;
 
 	// insert node */
 	struct {
 	    char *relname;
 	    struct node *attrlist;
+	    struct node *rows;		// list of value lists
 	} INSERT;
 
 	// delete node */
@@ -101,6 +113,7 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *primattr;
+	    char *layout;
 	} CREATE;
 
 	// destroy node */
@@ -137,6 +150,23 @@ typedef struct node {
 	    char *relname;
 	} HELP;
 
+	// analyze node */
+	struct {
+	    char *relname;
+	} ANALYZE;
+
+	// set node */
+	struct {
+	    char *name;
+	    int value;
+	    char *unit;
+	} SET;
+
+	// explain node */
+	struct {
+	    struct node *query;
+	} EXPLAIN;
+
 	// select node */
 	struct {
 	    struct node *selattr;
@@ -154,9 +184,24 @@ typedef struct node {
 	// qualified attribute node */
 	struct {
 	    char *relname;
-	    char *attrname;
+	    char *attrname;		// empty for count(*)
+	    int aggr;			// aggregate applied to it, if any
 	} QUALATTR;
 
+	// tablesample node
+	struct {
+	    char *relname;		// relation sampled
+	    char *method;		// system or bernoulli, NULL if none given
+	    float percent;
+	} SAMPLE;
+
+	// order by node
+	struct {
+	    struct node *orderattr;
+	    int descending;
+	    int limit;			// -1 if there is none
+	} ORDER;
+
 	// primary attribute node */
 	struct {
 	    char *attrname;
@@ -202,6 +247,7 @@ typedef struct node {
 	struct {
 	  char *relname;
 	  char *alias;
+	  struct node *sample;		// tablesample, or NULL
 	} ALIAS;
     } u;
 } NODE;
@@ -212,10 +258,15 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
-NODE *insert_node(char *relname, NODE *attrlist);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n,
+		 NODE *grouplist, int distinct, NODE *order, NODE *sample);
+NODE *setop_node(NODE *query, int setop, NODE *setquery);
+NODE *order_node(NODE *orderattr, int descending, int limit);
+NODE *sample_node(char *method, float percent);
+NODE *insert_node(char *relname, NODE *attrlist, NODE *rows);
 NODE *delete_node(char *relname, NODE *qual);
-NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
+NODE *create_node(char *relname, NODE *attrlist, NODE *primattr,
+		  char *layout);
 NODE *destroy_node(char *relname);
 NODE *build_node(char *relname, char *attrname, int nbuckets);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
@@ -223,9 +274,13 @@ NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
 NODE *print_node(char *relname);
 NODE *help_node(char *relname);
+NODE *analyze_node(char *relname);
+NODE *set_node(char *name, int value, char *unit);
+NODE *explain_node(NODE *query);
 NODE *select_node(NODE *selattr, int op, NODE *value);
 NODE *join_node(NODE *joinattr1, int op, NODE *joinattr2);
 NODE *qualattr_node(char *relname, char *attrname);
+NODE *aggr_node(int aggr, NODE *qualattr);
 NODE *primattr_node(char *attrname, int nbuckets);
 NODE *attrval_node(char *attrname, NODE *value);
 //attrtype_node need to change due to change of NODE.ATTRTYPE
@@ -236,7 +291,8 @@ NODE *string_node(char *s);
 NODE *list_node(NODE *n);
 NODE *prepend(NODE *n, NODE *list);
 NODE *merge_attr_value_list(NODE *attr_list, NODE *value_list);
-NODE *alias_node(char *relname, char *alias);
+NODE *alias_node(char *relname, char *alias, NODE *sample);
+NODE *sample_in_alias_list(NODE *alias);
 NODE *replace_alias_in_qualattr_list(NODE *alias, NODE *qualattr_list);
 NODE *replace_alias_in_condition(NODE *alias, NODE *where);
 #endif
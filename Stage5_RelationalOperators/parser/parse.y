@@ -6,6 +6,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "heapfile.h"
+#include "catalog.h"
+#include "query.h"
 #include "parse.h"
 
 extern "C" int isatty(int);
@@ -14,7 +16,7 @@ extern int yywrap();
 extern void reset_scanner();
 extern void quit();
 
-void yyerror(char *);
+void yyerror(const char *);
 
 extern char *yytext;                    // tokens in string format
 static NODE *parse_tree;                // root of parse tree
@@ -72,14 +74,45 @@ static NODE *parse_tree;                // root of parse tree
 		T_QSTRING
 		T_SHELL_CMD
 
+%token		RW_ANALYZE
+%token		RW_SET
+%token		RW_EXPLAIN
+%token		RW_TABLESAMPLE
+
+%token		RW_GROUP
+		RW_BY
+		RW_COUNT
+		RW_SUM
+		RW_MIN
+		RW_MAX
+		RW_AVG
+		RW_DISTINCT
+		RW_UNION
+		RW_INTERSECT
+		RW_EXCEPT
+		RW_ORDER
+		RW_ASC
+		RW_DESC
+		RW_LIMIT
+
 %type	<ival>	op
+		aggr
+		opt_distinct
+		set_op
+		opt_desc
+		opt_limit
+
+%type	<rval>	percent
 
 %type	<sval>	opt_into_relname
 		opt_relname
+		opt_layout
+		opt_unit
 		string
 
 %type	<n>	command
 		query
+		simple_query
 		insert
 		delete
 		create
@@ -92,13 +125,20 @@ static NODE *parse_tree;                // root of parse tree
 		load
 		print
 		help
+		analyze
+		set
+		explain
 		quit
 		opt_primary_attr
 		opt_where
+		opt_group_by
+		opt_order_by
 		qual
 		selection
 		join
 		non_mt_qualattr_list
+		non_mt_selattr_list
+		selattr
 		qualattr
 /*
 		non_mt_attrval_list
@@ -110,9 +150,11 @@ static NODE *parse_tree;                // root of parse tree
 		attrib
 		attrib_list
 		value_list
+		row_list
 		val
 		table_list
 		table
+		opt_sample
 %%
 
 start
@@ -155,6 +197,9 @@ command
 	| load
 	| print
 	| help
+	| analyze
+	| set
+	| explain
 	| quit
 	| nothing
 	{
@@ -163,26 +208,74 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: simple_query
+	| simple_query set_op simple_query
+	{
+		if ($1 == NULL || $3 == NULL)
+		  $$ = NULL;
+		else
+		  $$ = setop_node($1, $2, $3);
+	}
+	;
+
+simple_query
+	: RW_SELECT opt_distinct non_mt_selattr_list opt_into_relname RW_FROM
+	  table_list opt_where opt_group_by opt_order_by
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
-		NODE *qualattr_list = replace_alias_in_qualattr_list($5, $2);
-		if (qualattr_list == NULL) { // something wrong in qualattr_list
-		  $$ = NULL;
+		NODE *group_list = NULL;
+		NODE *qualattr_list = replace_alias_in_qualattr_list($6, $3);
+		if ($8 != NULL)
+		  group_list = replace_alias_in_qualattr_list($6, $8);
+		if (qualattr_list == NULL || (group_list == NULL && $8 != NULL)
+		    || ($9 != NULL && replace_alias_in_qualattr_list($6,
+				list_node($9->u.ORDER.orderattr)) == NULL)) {
+		  $$ = NULL; // something wrong in qualattr_list, group or order by
 		}
 		else {
-		  where = replace_alias_in_condition($5, $6);
-		  if ((where == NULL) && ($6 != NULL)) {
+		  where = replace_alias_in_condition($6, $7);
+		  if ((where == NULL) && ($7 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($4, qualattr_list, where, group_list, $2, $9,
+				    sample_in_alias_list($6));
 		  }
 		}
 	}
 	;
 
+opt_distinct
+	: RW_DISTINCT
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+set_op
+	: RW_UNION
+	{
+		$$ = UnionOp;
+	}
+	| RW_UNION RW_ALL
+	{
+		$$ = UnionAllOp;
+	}
+	| RW_INTERSECT
+	{
+		$$ = IntersectOp;
+	}
+	| RW_EXCEPT
+	{
+		$$ = ExceptOp;
+	}
+	;
+
 table_list
 	: '(' table_list ')'
 	{
@@ -198,21 +291,64 @@ table_list
 	}
 	
 table
-	: string  string  /* relation alias */
+	: string  string  opt_sample  /* relation alias */
+	{
+		$$ = alias_node($1, $2, $3);
+	}
+	| string opt_sample /* no alias */
+	{
+		$$ = alias_node($1, NULL, $2);
+	}
+
+opt_sample
+	: RW_TABLESAMPLE '(' percent '%' ')'
+	{
+		$$ = sample_node(NULL, $3);
+	}
+	| RW_TABLESAMPLE string '(' percent '%' ')'
+	{
+		$$ = sample_node($2, $4);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+percent
+	: T_INT
 	{
-		$$ = alias_node($1, $2);
+		$$ = $1;
 	}
-	| string /* no alias */
+	| T_REAL
 	{
-		$$ = alias_node($1, NULL);
+		$$ = $1;
 	}
+	;
 
 insert
-	: RW_INSERT RW_INTO string '(' attrib_list ')' RW_VALUES '(' value_list ')' 
+	: RW_INSERT RW_INTO string '(' attrib_list ')' RW_VALUES row_list
+	{
+		// every row must have a value for every attribute; the
+		// values of each row are merged in again before it is
+		// inserted
+		NODE* row;
+		for (row = $8; row != NULL; row = row->u.LIST.next)
+		  if (merge_attr_value_list($5, row->u.LIST.self) == NULL)
+		    break;
+		if (row != NULL) $$=NULL;
+		else $$ = insert_node($3, $5, $8);
+	}
+	;
+
+row_list
+	: '(' value_list ')' ',' row_list
+	{
+		$$ = prepend($2, $5);
+	}
+	| '(' value_list ')'
 	{
-		NODE* tmp = merge_attr_value_list($5, $9);
-		if (tmp == NULL) $$=NULL;
-		else $$ = insert_node($3, tmp);
+		$$ = list_node($2);
 	}
 	;
 
@@ -257,8 +393,9 @@ delete
 
 create
 	: RW_CREATE RW_TABLE string '(' non_mt_attrtype_list ')' opt_primary_attr
+	  opt_layout
 	{
-		$$ = create_node($3, $5, $7);
+		$$ = create_node($3, $5, $7, $8);
 	}
 	;
 
@@ -316,6 +453,49 @@ help
 	}
 	;
 
+analyze
+	: RW_ANALYZE RW_TABLE string
+	{
+		$$ = analyze_node($3);
+	}
+	| RW_ANALYZE string
+	{
+		$$ = analyze_node($2);
+	}
+	;
+
+set
+	: RW_SET string T_EQ T_INT opt_unit
+	{
+		$$ = set_node($2, $4, $5);
+	}
+	;
+
+explain
+	: RW_EXPLAIN RW_ANALYZE query
+	{
+		if ($3 == NULL)
+		  $$ = NULL;
+		else
+		  $$ = explain_node($3);
+	}
+	| RW_EXPLAIN RW_ANALYZE delete
+	{
+		$$ = explain_node($3);
+	}
+	;
+
+opt_unit
+	: string
+	{
+		$$ = $1;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
 quit
 	: RW_QUIT ';'
 	{
@@ -334,6 +514,65 @@ opt_primary_attr
 	}
 	;
 
+opt_layout
+	: RW_AS string
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_group_by
+	: RW_GROUP RW_BY non_mt_qualattr_list
+	{
+		$$ = $3;
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_order_by
+	: RW_ORDER RW_BY qualattr opt_desc opt_limit
+	{
+		$$ = order_node($3, $4, $5);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_desc
+	: RW_DESC
+	{
+		$$ = 1;
+	}
+	| RW_ASC
+	{
+		$$ = 0;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 opt_into_relname
 	: RW_INTO string
 	{
@@ -401,6 +640,56 @@ non_mt_qualattr_list
 	}
 	;
 
+non_mt_selattr_list
+	: '(' non_mt_selattr_list ')'
+	{
+		$$ = $2;
+	}
+	| selattr ',' non_mt_selattr_list
+	{
+		$$ = prepend($1, $3);
+	}
+	| selattr
+	{
+		$$ = list_node($1);
+	}
+	;
+
+selattr
+	: qualattr
+	| aggr '(' qualattr ')'
+	{
+		$$ = aggr_node($1, $3);
+	}
+	| aggr '(' '*' ')'
+	{
+		$$ = aggr_node($1, qualattr_node(NULL, (char *) ""));
+	}
+	;
+
+aggr
+	: RW_COUNT
+	{
+		$$ = CountAgg;
+	}
+	| RW_SUM
+	{
+		$$ = SumAgg;
+	}
+	| RW_MIN
+	{
+		$$ = MinAgg;
+	}
+	| RW_MAX
+	{
+		$$ = MaxAgg;
+	}
+	| RW_AVG
+	{
+		$$ = AvgAgg;
+	}
+	;
+
 qualattr
 	: string '.' string
 	{
@@ -536,7 +825,7 @@ void parse(void)
 }
 
 
-void yyerror(char *s)
+void yyerror(const char *s)
 {
   puts(s);
 }
@@ -93,7 +93,26 @@ extern int yydebug;
     T_REAL = 294,                  /* T_REAL  */
     T_STRING = 295,                /* T_STRING  */
     T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    T_SHELL_CMD = 297,             /* T_SHELL_CMD  */
+    RW_ANALYZE = 298,              /* RW_ANALYZE  */
+    RW_SET = 299,                  /* RW_SET  */
+    RW_EXPLAIN = 300,              /* RW_EXPLAIN  */
+    RW_TABLESAMPLE = 301,          /* RW_TABLESAMPLE  */
+    RW_GROUP = 302,                /* RW_GROUP  */
+    RW_BY = 303,                   /* RW_BY  */
+    RW_COUNT = 304,                /* RW_COUNT  */
+    RW_SUM = 305,                  /* RW_SUM  */
+    RW_MIN = 306,                  /* RW_MIN  */
+    RW_MAX = 307,                  /* RW_MAX  */
+    RW_AVG = 308,                  /* RW_AVG  */
+    RW_DISTINCT = 309,             /* RW_DISTINCT  */
+    RW_UNION = 310,                /* RW_UNION  */
+    RW_INTERSECT = 311,            /* RW_INTERSECT  */
+    RW_EXCEPT = 312,               /* RW_EXCEPT  */
+    RW_ORDER = 313,                /* RW_ORDER  */
+    RW_ASC = 314,                  /* RW_ASC  */
+    RW_DESC = 315,                 /* RW_DESC  */
+    RW_LIMIT = 316                 /* RW_LIMIT  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -142,19 +161,38 @@ extern int yydebug;
 #define T_STRING 295
 #define T_QSTRING 296
 #define T_SHELL_CMD 297
+#define RW_ANALYZE 298
+#define RW_SET 299
+#define RW_EXPLAIN 300
+#define RW_TABLESAMPLE 301
+#define RW_GROUP 302
+#define RW_BY 303
+#define RW_COUNT 304
+#define RW_SUM 305
+#define RW_MIN 306
+#define RW_MAX 307
+#define RW_AVG 308
+#define RW_DISTINCT 309
+#define RW_UNION 310
+#define RW_INTERSECT 311
+#define RW_EXCEPT 312
+#define RW_ORDER 313
+#define RW_ASC 314
+#define RW_DESC 315
+#define RW_LIMIT 316
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 23 "parse.y"
+#line 25 "parse.y"
 
   int ival;
   float rval;
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 196 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
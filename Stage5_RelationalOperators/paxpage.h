@@ -0,0 +1,159 @@
+#ifndef PAXPAGE_H
+#define PAXPAGE_H
+
+#include "page.h"
+
+struct RecFormat;
+
+// Class definition for a minirel data page in PAX layout.  The page
+// holds up to capacity records of the same length, but stores the
+// values of each attribute together in a minipage, so that a scan
+// testing one attribute reads only that minipage.  A bitmap records
+// which slots are in use; records are assembled from the minipages
+// when they are read.  A PaxPage lives in the same buffer frames as a
+// Page, and nextPage and curPage are in the same place as in a Page,
+// so Page::getNextPage() and setNextPage() work on it as well.  The
+// attributes are described by the RecFormat of the heap file.
+
+const unsigned PAXFIXED = 4*sizeof(short) + 2*sizeof(int);
+
+class PaxPage {
+private:
+    char	data[PAGESIZE - PAXFIXED]; // bitmap, then minipages
+    short	slotCnt;	// slots used so far, in use or freed
+    short	recCnt;		// slots in use
+    short	capacity;	// records that fit on the page
+    short	dataStart;	// offset of first minipage in data[]
+    int		nextPage;	// forwards pointer
+    int		curPage;	// page number of current pointer
+
+    const bool inUse(const int slotNo) const
+	{ return (data[slotNo / 8] >> (slotNo % 8)) & 1; }
+
+public:
+    // initialize a new page for records in the given format
+    void init(const int pageNo, const RecFormat & format);
+
+    // inserts a new record (rec) into the page, returns RID of record
+    const Status insertRecord(const RecFormat & format,
+			      const Record & rec, RID& rid);
+
+    // delete the record with the specified rid
+    const Status deleteRecord(const RID & rid);
+
+    // returns RID of first record on page
+    // returns  NORECORDS if page contains no records.  Otherwise, returns OK
+    const Status firstRecord(RID& firstRid) const;
+
+    // returns RID of next record on the page
+    // returns ENDOFPAGE if no more records exist on the page
+    const Status nextRecord (const RID & curRid, RID& nextRid) const;
+
+    // assembles the record with RID rid in rec, format.recLen bytes
+    const Status getRecord(const RecFormat & format,
+			   const RID & rid, char* rec) const;
+
+    // returns pointer to the value of the attribute at attrOffset,
+    // attrLen bytes long, of the record with RID rid
+    const char* getValue(const RID & rid, const int attrOffset,
+			 const int attrLen) const
+	{ return data + dataStart + capacity * attrOffset
+	    + rid.slotNo * attrLen; }
+};
+
+// A CPaxPage holds the minipages of a PAX page compressed, so that it
+// fits more records than a PaxPage.  Each attribute is encoded in the
+// smallest of a few lightweight schemes: plain values, runs of equal
+// values, a dictionary of the distinct values (trailing null bytes
+// dropped) with bit-packed codes, or for 4-byte values bit-packed
+// offsets from their minimum (frame of reference) or from the previous
+// value (delta).  A page is modified by decoding it into a PaxImage,
+// changing the image and encoding it again.  Deleting a record only
+// clears its bit in the bitmap, which is kept uncompressed.
+
+const int CPAXSLOTS = 1024;		// max. records on a CPaxPage
+
+// decoded contents of a CPaxPage: a bitmap of the used slots and the
+// values of each attribute, with room for CPAXSLOTS values each
+struct PaxImage {
+    int		pageNo;		// page decoded, -1 if none
+    int		slotCnt;	// slots used so far, in use or freed
+    int		recCnt;		// slots in use
+    unsigned char used[CPAXSLOTS / 8]; // bitmap of slots in use
+    char*	values;		// attribute arrays, in record order
+
+    char* getValue(const int slotNo, const int attrOffset,
+		   const int attrLen) const
+	{ return values + CPAXSLOTS * attrOffset + slotNo * attrLen; }
+};
+
+class CPaxPage {
+private:
+    char	data[PAGESIZE - PAXFIXED]; // attribute offsets, bitmap,
+					   // then encoded attributes
+    short	slotCnt;	// slots used so far, in use or freed
+    short	recCnt;		// slots in use
+    short	dataLen;	// bytes of data[] used
+    short	attrCnt;	// number of encoded attributes
+    int		nextPage;	// forwards pointer
+    int		curPage;	// page number of current pointer
+
+    const bool inUse(const int slotNo) const
+	{ return (data[attrCnt * sizeof(short) + slotNo / 8]
+		  >> (slotNo % 8)) & 1; }
+
+    friend class CPaxReader;
+
+public:
+    // initialize a new, empty page
+    void init(const int pageNo);
+
+    // encode image into the page.  Returns NOSPACE, leaving the page
+    // unchanged, if it does not fit
+    const Status pack(const RecFormat & format, const PaxImage & image);
+
+    // decode the page into image
+    void unpack(const RecFormat & format, PaxImage & image) const;
+
+    // delete the record with the specified rid
+    const Status deleteRecord(const RID & rid);
+
+    // returns RID of first record on page
+    // returns  NORECORDS if page contains no records.  Otherwise, returns OK
+    const Status firstRecord(RID& firstRid) const;
+
+    // returns RID of next record on the page
+    // returns ENDOFPAGE if no more records exist on the page
+    const Status nextRecord (const RID & curRid, RID& nextRid) const;
+};
+
+// Reads the values of one attribute of a CPaxPage in slot order, a run
+// of equal values at a time, without decoding the other attributes.
+// For a dictionary-encoded attribute code numbers the distinct value,
+// so that a caller testing values can test each one once; otherwise
+// code is -1.
+
+class CPaxReader {
+private:
+    const unsigned char* pos;	// next encoded byte
+    int		kind;		// encoding of the attribute
+    int		len;		// length of a value
+    int		left;		// values not read yet
+    int		width;		// bits of a packed value
+    long	bitPos;		// next packed bit
+    long long	base;		// minimum, or previous value for deltas
+    long long	minDelta;	// smallest delta
+    bool	first;		// first delta-encoded value not read yet
+    int		entryCnt;	// entries of a dictionary
+    const unsigned char* entry[CPAXSLOTS]; // dictionary entries
+    int		val[PAGESIZE / sizeof(int)]; // current value, aligned
+
+public:
+    CPaxReader(const CPaxPage* page, const RecFormat & format,
+	       const int attr);
+
+    // returns false after the last value
+    const bool next(const char* & value, int & count, int & code);
+};
+
+#endif
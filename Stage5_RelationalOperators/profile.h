@@ -0,0 +1,64 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <sys/time.h>
+#include <string>
+#include <vector>
+#include "page.h"
+#include "buf.h"
+using namespace std;
+
+
+// what explain analyze reports about one operator of a query
+
+struct OpCounters
+{
+  string name;                          // operator and what it works on
+  int depth;                            // nesting below the query
+  long long usec;                       // wall time
+  int tuplesIn;                         // tuples read from its inputs
+  int tuplesOut;                        // tuples produced
+  int pagesRead;                        // pages read from disk
+  int pagesWritten;                     // pages written to disk
+  int hits;                             // buffer pool hits
+  int misses;                           // buffer pool misses
+  int runs;                             // sorted runs written
+  int partitions;                       // partitions written
+};
+
+
+// An OpProfile measures an operator from its construction to its
+// destruction, so an operator declares one at its top with a name and
+// counts its tuples, runs and partitions in it.  Nothing is measured
+// unless explain analyze is profiling a query: the constructor and
+// destructor then only test a flag and the counters are plain ints.
+// Page and buffer counts come from the BufStats of bufMgr and include
+// those of nested operators.
+
+class OpProfile {
+ public:
+  OpProfile(const char* op, const string & what = "");
+  ~OpProfile();
+
+  int tuplesIn;
+  int tuplesOut;
+  int runs;
+  int partitions;
+
+  // start profiling the operators of a query
+  static void start();
+
+  // stop profiling and print the operators measured since start()
+  static void report();
+
+ private:
+  static bool profiling;                // between start() and report()
+  static vector<OpCounters> ops;        // in the order they started
+  static int depth;                     // of operators running now
+
+  int slot;                             // in ops, -1 if not profiling
+  struct timeval began;
+  BufStats statsAtStart;
+};
+
+#endif
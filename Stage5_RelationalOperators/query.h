@@ -3,7 +3,14 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+enum JoinType {NLJoin, SMJoin, HashJoin, BNLJoin, AutoJoin};
+
+// aggregate function of an attribute of an aggregation result; NoAgg
+// marks a group attribute
+enum AggFunc {NoAgg, CountAgg, SumAgg, MinAgg, MaxAgg, AvgAgg};
+
+// duplicate elimination of one input, or a set operation on two
+enum SetOp {DistinctOp, UnionOp, UnionAllOp, IntersectOp, ExceptOp};
 
 //
 // Prototypes for query layer functions
@@ -24,10 +31,58 @@ const Status QU_Join(const string & result,
 		     const Operator op, 
 		     const attrInfo *attr2);
 
+// groups the tuples of a relation that satisfy "attr op attrValue" (all
+// of them if attr is NULL) on groupNames and computes aggs over each
+// group.  An empty attribute name counts the tuples of a group.
+const Status QU_Aggregate(const string & result,
+			  const int projCnt,
+			  const attrInfo projNames[],
+			  const AggFunc aggs[],
+			  const int groupCnt,
+			  const attrInfo groupNames[],
+			  const attrInfo *attr,
+			  const Operator op,
+			  const char *attrValue);
+
+// combines the projections of two relations, restricted to the tuples
+// that satisfy "attr1 op1 attrValue1" and "attr2 op2 attrValue2" (all
+// of them if the attribute is NULL), with the set operation setOp.
+// DistinctOp takes the first relation only.
+const Status QU_SetOp(const string & result,
+		      const SetOp setOp,
+		      const int projCnt,
+		      const attrInfo projNames1[],
+		      const attrInfo *attr1,
+		      const Operator op1,
+		      const char *attrValue1,
+		      const attrInfo projNames2[],
+		      const attrInfo *attr2,
+		      const Operator op2,
+		      const char *attrValue2);
+
+// selects the tuples of a relation that satisfy "attr op attrValue"
+// (all of them if attr is NULL) in order of orderAttr, largest first if
+// descending, keeping only the first limit of them if limit >= 0
+const Status QU_OrderBy(const string & result,
+			const int projCnt,
+			const attrInfo projNames[],
+			const attrInfo *attr,
+			const Operator op,
+			const char *attrValue,
+			const attrInfo *orderAttr,
+			const bool descending,
+			const int limit);
+
 const Status QU_Insert(const string & relation, 
 		       const int attrCnt, 
 		       const attrInfo attrList[]);
 
+// end of an insert statement; the relation is kept open
+const Status QU_InsertSync();
+
+// close the relation kept open by QU_Insert
+const Status QU_InsertDone();
+
 const Status QU_Delete(const string & relation, 
 		       const string & attrName, 
 		       const Operator op,
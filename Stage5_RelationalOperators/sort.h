@@ -24,7 +24,13 @@ class SortedFile {
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     bool descending = false,   // largest values first
+	     int filterOffset = 0,      // sort only the records that
+	     int filterLength = 0,      // satisfy this filter, given
+	     Datatype filterType = STRING, // as to startScan()
+	     const char* filter = NULL,
+	     Operator op = EQ);
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -35,6 +41,7 @@ class SortedFile {
   Status sortFile();                    // split source file into sub-runs
   Status generateRun(int numItems);     // generate one sub-run of file
   Status startScans();                  // start a scan on each sorted run
+  Status mergeRuns(unsigned int count); // merge the first count runs
 
   typedef struct {
     string name;                        // name of run file
@@ -54,6 +61,14 @@ class SortedFile {
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
+  int order;                            // 1 if ascending, -1 if not
+  int filterOffset;                     // filter of the source file scan
+  int filterLength;
+  Datatype filterType;
+  const char* filter;
+  Operator op;
+  int sortId;                           // distinguishes our run files
+  int runCnt;                           // run files created so far
 
   SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer